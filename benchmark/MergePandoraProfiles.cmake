@@ -0,0 +1,25 @@
+# cmake script for merging the raw Clang profiles written by a PANDORA_PGO=GENERATE training run, invoke with cmake -P
+#
+# Input variables:
+#   PROFDATA_EXECUTABLE path of llvm-profdata
+#   PROFILE_DIRECTORY   directory holding the *.profraw files, default.profdata is written there for the PANDORA_PGO=USE stage
+#-------------------------------------------------------------------------------------------------------------------------------------------
+cmake_minimum_required(VERSION 3.0 FATAL_ERROR)
+
+if(NOT PROFDATA_EXECUTABLE)
+    message(FATAL_ERROR "MergePandoraProfiles: PROFDATA_EXECUTABLE not specified.")
+endif()
+
+file(GLOB _raw_profiles "${PROFILE_DIRECTORY}/*.profraw")
+if(NOT _raw_profiles)
+    message(FATAL_ERROR "MergePandoraProfiles: no raw profiles found in ${PROFILE_DIRECTORY}, check that the training job ran against the "
+        "libraries built with PANDORA_PGO=GENERATE.")
+endif()
+
+execute_process(COMMAND ${PROFDATA_EXECUTABLE} merge -output=${PROFILE_DIRECTORY}/default.profdata ${_raw_profiles} RESULT_VARIABLE _result)
+if(NOT _result EQUAL 0)
+    message(FATAL_ERROR "MergePandoraProfiles: llvm-profdata merge failed with status ${_result}.")
+endif()
+
+list(LENGTH _raw_profiles _n_raw_profiles)
+message(STATUS "Merged ${_n_raw_profiles} raw profiles into ${PROFILE_DIRECTORY}/default.profdata")
@@ -0,0 +1,101 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/include/MicroBenchmarkAlgorithm.h
+ *
+ *  @brief  Header file for the micro-benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+#ifndef MICRO_BENCHMARK_ALGORITHM_H
+#define MICRO_BENCHMARK_ALGORITHM_H 1
+
+#include "Pandora/Algorithm.h"
+
+namespace micro_benchmark
+{
+
+class MicroBenchmarkTimers;
+
+/**
+ *  @brief  MicroBenchmarkAlgorithm class, timing the content api cluster and list operations on the current calo hits
+ */
+class MicroBenchmarkAlgorithm : public pandora::Algorithm
+{
+public:
+    /**
+     *  @brief  Factory class for instantiating algorithm
+     */
+    class Factory : public pandora::AlgorithmFactory
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pTimers address of the timers to which the algorithm adds its operation times
+         */
+        Factory(MicroBenchmarkTimers *const pTimers);
+
+        pandora::Algorithm *CreateAlgorithm() const;
+
+    private:
+        MicroBenchmarkTimers *const m_pTimers;      ///< Address of the timers to which the algorithm adds its operation times
+    };
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pTimers address of the timers to which the algorithm adds its operation times
+     */
+    MicroBenchmarkAlgorithm(MicroBenchmarkTimers *const pTimers);
+
+private:
+    pandora::StatusCode Run();
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    /**
+     *  @brief  Create one cluster per calo hit in a temporary cluster list, which is left as the current list
+     *
+     *  @param  caloHitList the calo hit list
+     */
+    pandora::StatusCode CreateClusters(const pandora::CaloHitList &caloHitList) const;
+
+    /**
+     *  @brief  Merge the clusters in the current list in pairs, halving their number
+     */
+    pandora::StatusCode MergeClusters() const;
+
+    /**
+     *  @brief  Save the current temporary cluster list and make the saved list current
+     */
+    pandora::StatusCode SaveAndReplaceClusterList() const;
+
+    /**
+     *  @brief  Fragment each cluster in the current list into two halves and keep the fragments
+     */
+    pandora::StatusCode FragmentClusters() const;
+
+    /**
+     *  @brief  Delete, one by one, the clusters in the current list
+     */
+    pandora::StatusCode DeleteClusters() const;
+
+    MicroBenchmarkTimers *const m_pTimers;          ///< Address of the timers to which the algorithm adds its operation times
+    std::string                 m_clusterListName;  ///< The name under which the benchmark clusters are saved
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline MicroBenchmarkAlgorithm::Factory::Factory(MicroBenchmarkTimers *const pTimers) :
+    m_pTimers(pTimers)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline pandora::Algorithm *MicroBenchmarkAlgorithm::Factory::CreateAlgorithm() const
+{
+    return new MicroBenchmarkAlgorithm(m_pTimers);
+}
+
+} // namespace micro_benchmark
+
+#endif // #ifndef MICRO_BENCHMARK_ALGORITHM_H
@@ -0,0 +1,37 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/include/MicroBenchmarkPseudoLayerPlugin.h
+ *
+ *  @brief  Header file for the micro-benchmark pseudo layer plugin class.
+ *
+ *  $Log: $
+ */
+#ifndef MICRO_BENCHMARK_PSEUDO_LAYER_PLUGIN_H
+#define MICRO_BENCHMARK_PSEUDO_LAYER_PLUGIN_H 1
+
+#include "Plugins/PseudoLayerPlugin.h"
+
+namespace micro_benchmark
+{
+
+/**
+ *  @brief  MicroBenchmarkPseudoLayerPlugin class, assigning pseudo layers in fixed steps along z for the synthetic events
+ */
+class MicroBenchmarkPseudoLayerPlugin : public pandora::PseudoLayerPlugin
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    MicroBenchmarkPseudoLayerPlugin();
+
+private:
+    unsigned int GetPseudoLayer(const pandora::CartesianVector &positionVector) const;
+    unsigned int GetPseudoLayerAtIp() const;
+    pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
+    float           m_layerThickness;       ///< The thickness of each pseudo layer along z, units mm
+};
+
+} // namespace micro_benchmark
+
+#endif // #ifndef MICRO_BENCHMARK_PSEUDO_LAYER_PLUGIN_H
@@ -0,0 +1,85 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/include/MicroBenchmarkTimers.h
+ *
+ *  @brief  Header file for the micro-benchmark timers class.
+ *
+ *  $Log: $
+ */
+#ifndef MICRO_BENCHMARK_TIMERS_H
+#define MICRO_BENCHMARK_TIMERS_H 1
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace micro_benchmark
+{
+
+/**
+ *  @brief  MicroBenchmarkTimers class, accumulating the wall time spent in each named operation
+ */
+class MicroBenchmarkTimers
+{
+public:
+    /**
+     *  @brief  ScopedTimer class, adding the wall time between its construction and destruction to the named operation
+     */
+    class ScopedTimer
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  timers the timers to which the elapsed time is added
+         *  @param  operation the name of the timed operation
+         */
+        ScopedTimer(MicroBenchmarkTimers &timers, const std::string &operation);
+
+        /**
+         *  @brief  Destructor
+         */
+        ~ScopedTimer();
+
+    private:
+        MicroBenchmarkTimers                   &m_timers;          ///< The timers to which the elapsed time is added
+        const std::string                       m_operation;       ///< The name of the timed operation
+        std::chrono::steady_clock::time_point   m_startTime;       ///< The construction time
+    };
+
+    /**
+     *  @brief  Add wall time to a named operation, operations are reported in the order in which they are first added
+     *
+     *  @param  operation the name of the operation
+     *  @param  seconds the wall time, in seconds
+     */
+    void Add(const std::string &operation, const double seconds);
+
+    /**
+     *  @brief  Print the mean time per event and per hit of each operation to standard output
+     *
+     *  @param  nHitsPerEvent the number of hits in each event
+     *  @param  nEvents the number of events processed
+     */
+    void Print(const unsigned int nHitsPerEvent, const unsigned int nEvents) const;
+
+    /**
+     *  @brief  Append the mean time per event and per hit of each operation to a csv file, writing the header if the file is new or empty
+     *
+     *  @param  fileName the csv file name
+     *  @param  nHitsPerEvent the number of hits in each event
+     *  @param  nEvents the number of events processed
+     *
+     *  @return whether the file could be written
+     */
+    bool WriteCsv(const std::string &fileName, const unsigned int nHitsPerEvent, const unsigned int nEvents) const;
+
+private:
+    typedef std::vector<std::pair<std::string, double> > OperationList;
+
+    OperationList       m_operationList;        ///< The operation names and total wall times, in seconds
+};
+
+} // namespace micro_benchmark
+
+#endif // #ifndef MICRO_BENCHMARK_TIMERS_H
@@ -0,0 +1,182 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/src/MicroBenchmarkAlgorithm.cc
+ *
+ *  @brief  Implementation of the micro-benchmark algorithm class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "MicroBenchmarkAlgorithm.h"
+#include "MicroBenchmarkTimers.h"
+
+using namespace pandora;
+
+namespace micro_benchmark
+{
+
+MicroBenchmarkAlgorithm::MicroBenchmarkAlgorithm(MicroBenchmarkTimers *const pTimers) :
+    m_pTimers(pTimers),
+    m_clusterListName("MicroBenchmarkClusters")
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::Run()
+{
+    const CaloHitList *pCaloHitList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pCaloHitList));
+
+    {
+        MicroBenchmarkTimers::ScopedTimer timer(*m_pTimers, "ClusterCreate");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CreateClusters(*pCaloHitList));
+    }
+
+    {
+        MicroBenchmarkTimers::ScopedTimer timer(*m_pTimers, "ClusterMerge");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->MergeClusters());
+    }
+
+    {
+        MicroBenchmarkTimers::ScopedTimer timer(*m_pTimers, "ListSaveReplace");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SaveAndReplaceClusterList());
+    }
+
+    {
+        MicroBenchmarkTimers::ScopedTimer timer(*m_pTimers, "Fragmentation");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FragmentClusters());
+    }
+
+    {
+        MicroBenchmarkTimers::ScopedTimer timer(*m_pTimers, "ClusterDelete");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->DeleteClusters());
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::CreateClusters(const CaloHitList &caloHitList) const
+{
+    const ClusterList *pTemporaryList(nullptr);
+    std::string temporaryListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::CreateTemporaryListAndSetCurrent(*this, pTemporaryList, temporaryListName));
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+    {
+        PandoraContentApi::Cluster::Parameters parameters;
+        parameters.m_caloHitList.push_back(pCaloHit);
+
+        const Cluster *pCluster(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, parameters, pCluster));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::MergeClusters() const
+{
+    const ClusterList *pClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
+
+    // Copy, as merging removes clusters from the current list
+    const ClusterVector clusterVector(pClusterList->begin(), pClusterList->end());
+
+    for (unsigned int iCluster = 0; iCluster + 1 < clusterVector.size(); iCluster += 2)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, clusterVector.at(iCluster),
+            clusterVector.at(iCluster + 1)));
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::SaveAndReplaceClusterList() const
+{
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::SaveList<Cluster>(*this, m_clusterListName));
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ReplaceCurrentList<Cluster>(*this, m_clusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::FragmentClusters() const
+{
+    const ClusterList *pClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
+
+    const ClusterList originalClusterList(*pClusterList);
+    std::string originalListName, fragmentListName;
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::InitializeFragmentation(*this, originalClusterList,
+        originalListName, fragmentListName));
+
+    for (const Cluster *const pOriginalCluster : originalClusterList)
+    {
+        CaloHitList caloHitList;
+        pOriginalCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+        const unsigned int nFirstFragmentHits((caloHitList.size() + 1) / 2);
+        PandoraContentApi::Cluster::Parameters firstParameters, secondParameters;
+
+        for (const CaloHit *const pCaloHit : caloHitList)
+        {
+            if (firstParameters.m_caloHitList.size() < nFirstFragmentHits)
+            {
+                firstParameters.m_caloHitList.push_back(pCaloHit);
+            }
+            else
+            {
+                secondParameters.m_caloHitList.push_back(pCaloHit);
+            }
+        }
+
+        const Cluster *pFirstFragment(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, firstParameters, pFirstFragment));
+
+        if (!secondParameters.m_caloHitList.empty())
+        {
+            const Cluster *pSecondFragment(nullptr);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Cluster::Create(*this, secondParameters, pSecondFragment));
+        }
+    }
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::EndFragmentation<Cluster>(*this, fragmentListName, originalListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::DeleteClusters() const
+{
+    const ClusterList *pClusterList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetCurrentList(*this, pClusterList));
+
+    // Copy, as deletion removes clusters from the current list
+    const ClusterList clusterList(*pClusterList);
+
+    for (const Cluster *const pCluster : clusterList)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::Delete(*this, pCluster));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ClusterListName", m_clusterListName));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace micro_benchmark
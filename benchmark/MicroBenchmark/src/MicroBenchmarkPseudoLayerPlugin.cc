@@ -0,0 +1,53 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/src/MicroBenchmarkPseudoLayerPlugin.cc
+ *
+ *  @brief  Implementation of the micro-benchmark pseudo layer plugin class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/AlgorithmHeaders.h"
+
+#include "MicroBenchmarkPseudoLayerPlugin.h"
+
+#include <cmath>
+#include <limits>
+
+using namespace pandora;
+
+namespace micro_benchmark
+{
+
+MicroBenchmarkPseudoLayerPlugin::MicroBenchmarkPseudoLayerPlugin() :
+    m_layerThickness(10.f)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MicroBenchmarkPseudoLayerPlugin::GetPseudoLayer(const CartesianVector &positionVector) const
+{
+    return 1 + static_cast<unsigned int>(std::fabs(positionVector.GetZ()) / m_layerThickness);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int MicroBenchmarkPseudoLayerPlugin::GetPseudoLayerAtIp() const
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MicroBenchmarkPseudoLayerPlugin::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "LayerThickness", m_layerThickness));
+
+    if (m_layerThickness < std::numeric_limits<float>::epsilon())
+        return STATUS_CODE_INVALID_PARAMETER;
+
+    return STATUS_CODE_SUCCESS;
+}
+
+} // namespace micro_benchmark
@@ -0,0 +1,89 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/src/MicroBenchmarkTimers.cc
+ *
+ *  @brief  Implementation of the micro-benchmark timers class.
+ *
+ *  $Log: $
+ */
+
+#include "MicroBenchmarkTimers.h"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace micro_benchmark
+{
+
+MicroBenchmarkTimers::ScopedTimer::ScopedTimer(MicroBenchmarkTimers &timers, const std::string &operation) :
+    m_timers(timers),
+    m_operation(operation),
+    m_startTime(std::chrono::steady_clock::now())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+MicroBenchmarkTimers::ScopedTimer::~ScopedTimer()
+{
+    const std::chrono::duration<double> elapsed(std::chrono::steady_clock::now() - m_startTime);
+    m_timers.Add(m_operation, elapsed.count());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MicroBenchmarkTimers::Add(const std::string &operation, const double seconds)
+{
+    for (OperationList::value_type &operationEntry : m_operationList)
+    {
+        if (operationEntry.first == operation)
+        {
+            operationEntry.second += seconds;
+            return;
+        }
+    }
+
+    m_operationList.emplace_back(operation, seconds);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MicroBenchmarkTimers::Print(const unsigned int nHitsPerEvent, const unsigned int nEvents) const
+{
+    std::cout << "Micro-benchmark, " << nEvents << " events of " << nHitsPerEvent << " hits" << std::endl;
+
+    for (const OperationList::value_type &operationEntry : m_operationList)
+    {
+        std::cout << "  " << std::left << std::setw(20) << operationEntry.first << std::right << std::fixed << std::setprecision(3)
+                  << std::setw(12) << 1.e3 * operationEntry.second / nEvents << " ms/event"
+                  << std::setw(12) << 1.e9 * operationEntry.second / (static_cast<double>(nEvents) * nHitsPerEvent) << " ns/hit" << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool MicroBenchmarkTimers::WriteCsv(const std::string &fileName, const unsigned int nHitsPerEvent, const unsigned int nEvents) const
+{
+    std::ifstream existingFile(fileName);
+    const bool writeHeader(!existingFile.good() || (existingFile.peek() == std::ifstream::traits_type::eof()));
+    existingFile.close();
+
+    std::ofstream csvFile(fileName, std::ios::app);
+
+    if (!csvFile.good())
+        return false;
+
+    if (writeHeader)
+        csvFile << "n_hits,operation,ms_per_event,ns_per_hit" << std::endl;
+
+    for (const OperationList::value_type &operationEntry : m_operationList)
+    {
+        csvFile << nHitsPerEvent << "," << operationEntry.first << "," << std::fixed << std::setprecision(6)
+                << 1.e3 * operationEntry.second / nEvents << ","
+                << 1.e9 * operationEntry.second / (static_cast<double>(nEvents) * nHitsPerEvent) << std::endl;
+    }
+
+    return csvFile.good();
+}
+
+} // namespace micro_benchmark
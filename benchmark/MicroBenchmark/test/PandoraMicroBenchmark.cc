@@ -0,0 +1,253 @@
+/**
+ *  @file   PandoraPFA/benchmark/MicroBenchmark/test/PandoraMicroBenchmark.cc
+ *
+ *  @brief  Implementation of the pandora micro-benchmark, timing sdk and content api operations on synthetic events of controlled size.
+ *
+ *  $Log: $
+ */
+
+#include "Api/PandoraApi.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include "MicroBenchmarkAlgorithm.h"
+#include "MicroBenchmarkPseudoLayerPlugin.h"
+#include "MicroBenchmarkTimers.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <unistd.h>
+
+using namespace micro_benchmark;
+
+/**
+ *  @brief  Parameters class
+ */
+class Parameters
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    Parameters();
+
+    std::string     m_pandoraSettingsFile;      ///< The path to the pandora settings file
+    std::string     m_csvFileName;              ///< The csv file to which the operation times are appended (optional)
+    unsigned int    m_nEvents;                  ///< The number of synthetic events to process
+    unsigned int    m_nHitsPerEvent;            ///< The number of calo hits in each synthetic event
+    unsigned int    m_randomSeed;               ///< The seed for the synthetic hit positions and energies
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  Parse the command line arguments, setting the application parameters
+ *
+ *  @param  argc argument count
+ *  @param  argv argument vector
+ *  @param  parameters to receive the application parameters
+ *
+ *  @return success
+ */
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters);
+
+/**
+ *  @brief  Parse a positive integer command line value
+ *
+ *  @param  pValue the command line value
+ *  @param  value to receive the parsed value
+ *
+ *  @return success
+ */
+bool ParsePositiveInteger(const char *const pValue, unsigned int &value);
+
+/**
+ *  @brief  Create the calo hits of a synthetic event, uniformly distributed in a box
+ *
+ *  @param  pandora the pandora instance
+ *  @param  nHits the number of calo hits to create
+ *  @param  randomEngine the random number engine
+ */
+void CreateSyntheticCaloHits(const pandora::Pandora &pandora, const unsigned int nHits, std::mt19937 &randomEngine);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    try
+    {
+        Parameters parameters;
+
+        if (!ParseCommandLine(argc, argv, parameters))
+            return 1;
+
+        MicroBenchmarkTimers timers;
+        std::mt19937 randomEngine(parameters.m_randomSeed);
+
+        const pandora::Pandora *const pPandora = new pandora::Pandora();
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::SetPseudoLayerPlugin(*pPandora, new MicroBenchmarkPseudoLayerPlugin));
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::RegisterAlgorithmFactory(*pPandora, "MicroBenchmark",
+            new MicroBenchmarkAlgorithm::Factory(&timers)));
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::ReadPandoraSettings(*pPandora, parameters.m_pandoraSettingsFile));
+
+        for (unsigned int iEvent = 0; iEvent < parameters.m_nEvents; ++iEvent)
+        {
+            {
+                MicroBenchmarkTimers::ScopedTimer timer(timers, "CaloHitCreate");
+                CreateSyntheticCaloHits(*pPandora, parameters.m_nHitsPerEvent, randomEngine);
+            }
+
+            {
+                MicroBenchmarkTimers::ScopedTimer timer(timers, "ProcessEvent");
+                PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandora));
+            }
+
+            {
+                MicroBenchmarkTimers::ScopedTimer timer(timers, "Reset");
+                PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pPandora));
+            }
+        }
+
+        delete pPandora;
+
+        timers.Print(parameters.m_nHitsPerEvent, parameters.m_nEvents);
+
+        if (!parameters.m_csvFileName.empty() && !timers.WriteCsv(parameters.m_csvFileName, parameters.m_nHitsPerEvent, parameters.m_nEvents))
+        {
+            std::cerr << "PandoraMicroBenchmark: cannot write " << parameters.m_csvFileName << std::endl;
+            return 1;
+        }
+    }
+    catch (pandora::StatusCodeException &statusCodeException)
+    {
+        std::cerr << "Pandora Exception caught: " << statusCodeException.ToString() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParseCommandLine(int argc, char *argv[], Parameters &parameters)
+{
+    int c(0);
+
+    while ((c = getopt(argc, argv, "i:e:n:s:o:h")) != -1)
+    {
+        switch (c)
+        {
+        case 'i':
+            parameters.m_pandoraSettingsFile = optarg;
+            break;
+        case 'e':
+            if (!ParsePositiveInteger(optarg, parameters.m_nEvents))
+            {
+                std::cerr << "PandoraMicroBenchmark: invalid number of events '" << optarg << "'" << std::endl;
+                return false;
+            }
+            break;
+        case 'n':
+            if (!ParsePositiveInteger(optarg, parameters.m_nHitsPerEvent))
+            {
+                std::cerr << "PandoraMicroBenchmark: invalid number of hits per event '" << optarg << "'" << std::endl;
+                return false;
+            }
+            break;
+        case 's':
+            if (!ParsePositiveInteger(optarg, parameters.m_randomSeed))
+            {
+                std::cerr << "PandoraMicroBenchmark: invalid random seed '" << optarg << "'" << std::endl;
+                return false;
+            }
+            break;
+        case 'o':
+            parameters.m_csvFileName = optarg;
+            break;
+        case 'h':
+        default:
+            std::cout << std::endl << "PandoraMicroBenchmark " << std::endl
+                      << "    -i PandoraSettings.xml  (mandatory)" << std::endl
+                      << "    -e NEvents              (optional, default 10)" << std::endl
+                      << "    -n NHitsPerEvent        (optional, default 1000)" << std::endl
+                      << "    -s RandomSeed           (optional, default 1)" << std::endl
+                      << "    -o Output.csv           (optional, operation times are appended)" << std::endl << std::endl;
+            return false;
+        }
+    }
+
+    if (parameters.m_pandoraSettingsFile.empty())
+    {
+        std::cerr << "PandoraMicroBenchmark: a pandora settings file must be given with -i" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ParsePositiveInteger(const char *const pValue, unsigned int &value)
+{
+    char *pEnd(nullptr);
+    const unsigned long parsedValue(std::strtoul(pValue, &pEnd, 10));
+
+    if ((pEnd == pValue) || (*pEnd != '\0') || (pValue[0] == '-') || (parsedValue == 0) || (parsedValue > UINT32_MAX))
+        return false;
+
+    value = static_cast<unsigned int>(parsedValue);
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CreateSyntheticCaloHits(const pandora::Pandora &pandora, const unsigned int nHits, std::mt19937 &randomEngine)
+{
+    std::uniform_real_distribution<float> transverseDistribution(-1000.f, 1000.f);
+    std::uniform_real_distribution<float> longitudinalDistribution(0.f, 1000.f);
+    std::uniform_real_distribution<float> energyDistribution(0.001f, 1.f);
+
+    for (unsigned int iHit = 0; iHit < nHits; ++iHit)
+    {
+        const float energy(energyDistribution(randomEngine));
+
+        PandoraApi::CaloHit::Parameters parameters;
+        parameters.m_positionVector = pandora::CartesianVector(transverseDistribution(randomEngine), transverseDistribution(randomEngine),
+            longitudinalDistribution(randomEngine));
+        parameters.m_expectedDirection = pandora::CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellNormalVector = pandora::CartesianVector(0.f, 0.f, 1.f);
+        parameters.m_cellGeometry = pandora::RECTANGULAR;
+        parameters.m_cellSize0 = 10.f;
+        parameters.m_cellSize1 = 10.f;
+        parameters.m_cellThickness = 10.f;
+        parameters.m_nCellRadiationLengths = 1.f;
+        parameters.m_nCellInteractionLengths = 0.1f;
+        parameters.m_time = 0.f;
+        parameters.m_inputEnergy = energy;
+        parameters.m_mipEquivalentEnergy = 100.f * energy;
+        parameters.m_electromagneticEnergy = energy;
+        parameters.m_hadronicEnergy = energy;
+        parameters.m_isDigital = false;
+        parameters.m_hitType = pandora::ECAL;
+        parameters.m_hitRegion = pandora::SINGLE_REGION;
+        parameters.m_layer = 0;
+        parameters.m_isInOuterSamplingLayer = false;
+        parameters.m_pParentAddress = reinterpret_cast<void *>(static_cast<std::uintptr_t>(iHit + 1));
+
+        PANDORA_THROW_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, PandoraApi::CaloHit::Create(pandora, parameters));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+Parameters::Parameters() :
+    m_nEvents(10),
+    m_nHitsPerEvent(1000),
+    m_randomSeed(1)
+{
+}
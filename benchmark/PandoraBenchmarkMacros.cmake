@@ -0,0 +1,69 @@
+# helper functions shared by the Pandora benchmark scripts
+
+# Format an integer number of hundredths as a decimal string
+function(PANDORA_FORMAT_HUNDREDTHS value output)
+    math(EXPR _units "${value} / 100")
+    math(EXPR _fraction "${value} % 100")
+    if(_fraction LESS 10)
+        set(_fraction "0${_fraction}")
+    endif()
+    set(${output} "${_units}.${_fraction}" PARENT_SCOPE)
+endfunction()
+
+# Run a job command line, returning its wall time in ms and, if a GNU time executable is provided, its peak resident memory in kB (else 0)
+function(PANDORA_RUN_TIMED_JOB command_line working_directory time_executable wall_ms_output peak_rss_kb_output)
+    separate_arguments(_command UNIX_COMMAND "${command_line}")
+    set(_time_file "${CMAKE_CURRENT_BINARY_DIR}/PandoraBenchmarkTime.txt")
+    file(REMOVE ${_time_file})
+
+    if(time_executable)
+        set(_command ${time_executable} -f "%M" -o ${_time_file} ${_command})
+    endif()
+
+    string(TIMESTAMP _start_us "%s%f")
+    execute_process(COMMAND ${_command} WORKING_DIRECTORY ${working_directory} RESULT_VARIABLE _result)
+    string(TIMESTAMP _end_us "%s%f")
+
+    if(NOT _result EQUAL 0)
+        message(FATAL_ERROR "Pandora benchmark: job failed with status ${_result}: ${command_line}")
+    endif()
+
+    math(EXPR _wall_ms "(${_end_us} - ${_start_us}) / 1000")
+    if(_wall_ms LESS 1)
+        set(_wall_ms 1)
+    endif()
+
+    set(_peak_rss_kb 0)
+    if(EXISTS ${_time_file})
+        file(STRINGS ${_time_file} _time_lines REGEX "^[0-9]+$")
+        if(_time_lines)
+            list(GET _time_lines -1 _peak_rss_kb)
+        endif()
+        file(REMOVE ${_time_file})
+    endif()
+
+    set(${wall_ms_output} ${_wall_ms} PARENT_SCOPE)
+    set(${peak_rss_kb_output} ${_peak_rss_kb} PARENT_SCOPE)
+endfunction()
+
+# Run a job command line the given number of times, returning the fastest wall time in ms and the largest peak resident memory in kB
+function(PANDORA_RUN_REPEATED_JOB command_line working_directory time_executable n_repetitions min_wall_ms_output max_peak_rss_kb_output)
+    set(_min_wall_ms "")
+    set(_max_peak_rss_kb 0)
+
+    foreach(_repetition RANGE 1 ${n_repetitions})
+        PANDORA_RUN_TIMED_JOB("${command_line}" ${working_directory} "${time_executable}" _wall_ms _peak_rss_kb)
+        message(STATUS "  run ${_repetition}/${n_repetitions}: ${_wall_ms} ms")
+
+        if(_min_wall_ms STREQUAL "" OR _wall_ms LESS _min_wall_ms)
+            set(_min_wall_ms ${_wall_ms})
+        endif()
+
+        if(_peak_rss_kb GREATER _max_peak_rss_kb)
+            set(_max_peak_rss_kb ${_peak_rss_kb})
+        endif()
+    endforeach()
+
+    set(${min_wall_ms_output} ${_min_wall_ms} PARENT_SCOPE)
+    set(${max_peak_rss_kb_output} ${_max_peak_rss_kb} PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,172 @@
+# cmake script for running a Pandora benchmark job, invoke with cmake -P
+#
+# Runs BENCHMARK_COMMAND BENCHMARK_REPETITIONS times and takes the fastest run, so that a single slow run caused by other load on the
+# machine cannot fail the comparison. Reports events per second and the largest peak resident memory, then either stores the result as
+# the new baseline or compares it against the stored baseline, failing if throughput or memory regress by more than BENCHMARK_TOLERANCE
+# percent.
+#
+# The wall time of the job includes its start-up (plugin creation, settings parsing, geometry), which dominates for short jobs. If
+# BENCHMARK_STARTUP_COMMAND is set, normally the same job configured to process no events, its fastest wall time is subtracted so the
+# throughput reflects event processing only. Otherwise the reported throughput includes start-up time.
+#
+# Input variables:
+#   BENCHMARK_COMMAND           command line of the reconstruction job, e.g. "PandoraInterface -i PandoraSettings.xml -e events.pndr"
+#   BENCHMARK_N_EVENTS          number of events processed by the job
+#   BENCHMARK_STARTUP_COMMAND   command line of the same job processing no events, used to subtract start-up time (optional)
+#   BENCHMARK_REPETITIONS       number of times each job is run, the fastest run is used (default 5)
+#   BENCHMARK_BASELINE          path of the stored baseline file, if empty the job is run without any baseline comparison
+#   BENCHMARK_OUTPUT            path to which the result of this run is written
+#   BENCHMARK_TOLERANCE         allowed regression, in percent (default 5)
+#   BENCHMARK_UPDATE_BASELINE   if true, write the result of this run to BENCHMARK_BASELINE instead of comparing against it
+#   BENCHMARK_WORKING_DIRECTORY working directory for the job (optional)
+#   BENCHMARK_TIME_EXECUTABLE   GNU time executable, used to measure peak resident memory (optional)
+#   BENCHMARK_INSTRUMENTED      if true, the libraries are instrumented for profile generation and no baseline may be stored or compared
+#-------------------------------------------------------------------------------------------------------------------------------------------
+cmake_minimum_required(VERSION 3.23 FATAL_ERROR)
+
+if(NOT BENCHMARK_COMMAND)
+    message(FATAL_ERROR "RunPandoraBenchmark: BENCHMARK_COMMAND not specified, set PANDORA_BENCHMARK_COMMAND when configuring PandoraPFA.")
+endif()
+
+if(NOT BENCHMARK_N_EVENTS MATCHES "^[0-9]+$" OR NOT BENCHMARK_N_EVENTS GREATER 0)
+    message(FATAL_ERROR "RunPandoraBenchmark: BENCHMARK_N_EVENTS must be a positive integer, not '${BENCHMARK_N_EVENTS}'.")
+endif()
+
+if(NOT BENCHMARK_REPETITIONS)
+    set(BENCHMARK_REPETITIONS 5)
+endif()
+
+if(NOT BENCHMARK_REPETITIONS MATCHES "^[0-9]+$" OR NOT BENCHMARK_REPETITIONS GREATER 0)
+    message(FATAL_ERROR "RunPandoraBenchmark: BENCHMARK_REPETITIONS must be a positive integer, not '${BENCHMARK_REPETITIONS}'.")
+endif()
+
+if(NOT DEFINED BENCHMARK_TOLERANCE)
+    set(BENCHMARK_TOLERANCE 5)
+endif()
+
+if(NOT BENCHMARK_TOLERANCE MATCHES "^[0-9]+$" OR BENCHMARK_TOLERANCE GREATER 100)
+    message(FATAL_ERROR "RunPandoraBenchmark: BENCHMARK_TOLERANCE must be an integer percentage between 0 and 100, not '${BENCHMARK_TOLERANCE}'.")
+endif()
+
+if(BENCHMARK_INSTRUMENTED AND BENCHMARK_BASELINE)
+    message(FATAL_ERROR "RunPandoraBenchmark: libraries are built with PANDORA_PGO=GENERATE, their throughput is not representative. "
+        "Use the pgo_training target, or reconfigure with PANDORA_PGO=USE or empty before storing or comparing a baseline.")
+endif()
+
+if(NOT BENCHMARK_WORKING_DIRECTORY)
+    set(BENCHMARK_WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+endif()
+
+include(${CMAKE_CURRENT_LIST_DIR}/PandoraBenchmarkMacros.cmake)
+
+#-------------------------------------------------------------------------------------------------------------------------------------------
+# Run the job, and the start-up only job if provided
+message(STATUS "Running job ${BENCHMARK_REPETITIONS} times")
+PANDORA_RUN_REPEATED_JOB("${BENCHMARK_COMMAND}" ${BENCHMARK_WORKING_DIRECTORY} "${BENCHMARK_TIME_EXECUTABLE}" ${BENCHMARK_REPETITIONS}
+    _wall_ms _peak_rss_kb)
+set(_processing_ms ${_wall_ms})
+set(_startup_subtracted 0)
+
+if(BENCHMARK_STARTUP_COMMAND)
+    message(STATUS "Running start-up only job ${BENCHMARK_REPETITIONS} times")
+    PANDORA_RUN_REPEATED_JOB("${BENCHMARK_STARTUP_COMMAND}" ${BENCHMARK_WORKING_DIRECTORY} "" ${BENCHMARK_REPETITIONS} _startup_ms _unused_rss_kb)
+    math(EXPR _processing_ms "${_wall_ms} - ${_startup_ms}")
+    set(_startup_subtracted 1)
+
+    if(NOT _processing_ms GREATER 0)
+        message(FATAL_ERROR "RunPandoraBenchmark: job (${_wall_ms} ms) is no slower than its start-up (${_startup_ms} ms), increase the number of events.")
+    endif()
+endif()
+
+math(EXPR _events_per_second_x100 "(${BENCHMARK_N_EVENTS} * 100000) / ${_processing_ms}")
+
+PANDORA_FORMAT_HUNDREDTHS(${_events_per_second_x100} _events_per_second)
+message(STATUS "Events: ${BENCHMARK_N_EVENTS}")
+message(STATUS "Fastest wall time: ${_wall_ms} ms")
+
+if(_startup_subtracted)
+    message(STATUS "Fastest start-up time: ${_startup_ms} ms, subtracted")
+    message(STATUS "Throughput: ${_events_per_second} events/s")
+else()
+    message(STATUS "Throughput: ${_events_per_second} events/s (includes job start-up, set PANDORA_BENCHMARK_STARTUP_COMMAND to subtract it)")
+endif()
+
+if(_peak_rss_kb GREATER 0)
+    message(STATUS "Peak RSS: ${_peak_rss_kb} kB")
+else()
+    message(STATUS "Peak RSS: not measured (GNU time not found or gave no reading)")
+endif()
+
+set(_result_text "EVENTS_PER_SECOND_X100 ${_events_per_second_x100}\nPEAK_RSS_KB ${_peak_rss_kb}\nSTARTUP_SUBTRACTED ${_startup_subtracted}\n")
+
+if(BENCHMARK_OUTPUT)
+    file(WRITE ${BENCHMARK_OUTPUT} ${_result_text})
+endif()
+
+#-------------------------------------------------------------------------------------------------------------------------------------------
+# Store or compare against the baseline
+if(NOT BENCHMARK_BASELINE)
+    return()
+endif()
+
+if(BENCHMARK_UPDATE_BASELINE)
+    file(WRITE ${BENCHMARK_BASELINE} ${_result_text})
+    message(STATUS "Baseline written to ${BENCHMARK_BASELINE}")
+    return()
+endif()
+
+if(NOT EXISTS ${BENCHMARK_BASELINE})
+    message(STATUS "No baseline found at ${BENCHMARK_BASELINE}, build the benchmark_baseline target to create one")
+    return()
+endif()
+
+file(STRINGS ${BENCHMARK_BASELINE} _baseline_lines)
+set(_baseline_events_per_second_x100 "")
+set(_baseline_peak_rss_kb "")
+set(_baseline_startup_subtracted "")
+
+foreach(_line ${_baseline_lines})
+    if(_line MATCHES "^EVENTS_PER_SECOND_X100 ([0-9]+)$")
+        set(_baseline_events_per_second_x100 ${CMAKE_MATCH_1})
+    elseif(_line MATCHES "^PEAK_RSS_KB ([0-9]+)$")
+        set(_baseline_peak_rss_kb ${CMAKE_MATCH_1})
+    elseif(_line MATCHES "^STARTUP_SUBTRACTED ([01])$")
+        set(_baseline_startup_subtracted ${CMAKE_MATCH_1})
+    endif()
+endforeach()
+
+if(NOT _baseline_events_per_second_x100 GREATER 0 OR _baseline_peak_rss_kb STREQUAL "" OR _baseline_startup_subtracted STREQUAL "")
+    message(FATAL_ERROR "RunPandoraBenchmark: malformed baseline ${BENCHMARK_BASELINE}, expected positive EVENTS_PER_SECOND_X100, PEAK_RSS_KB and "
+        "STARTUP_SUBTRACTED entries, build the benchmark_baseline target to recreate it.")
+endif()
+
+if(NOT _baseline_startup_subtracted EQUAL _startup_subtracted)
+    message(FATAL_ERROR "RunPandoraBenchmark: baseline ${BENCHMARK_BASELINE} was recorded with STARTUP_SUBTRACTED ${_baseline_startup_subtracted}, "
+        "this run has ${_startup_subtracted}. Build the benchmark_baseline target to recreate it with the current BENCHMARK_STARTUP_COMMAND.")
+endif()
+
+set(_regressions "")
+PANDORA_FORMAT_HUNDREDTHS(${_baseline_events_per_second_x100} _baseline_events_per_second)
+message(STATUS "Baseline throughput: ${_baseline_events_per_second} events/s")
+
+math(EXPR _throughput_lhs "${_events_per_second_x100} * 100")
+math(EXPR _throughput_rhs "${_baseline_events_per_second_x100} * (100 - ${BENCHMARK_TOLERANCE})")
+if(_throughput_lhs LESS _throughput_rhs)
+    list(APPEND _regressions "throughput ${_events_per_second} events/s vs baseline ${_baseline_events_per_second} events/s")
+endif()
+
+if(_peak_rss_kb GREATER 0 AND _baseline_peak_rss_kb GREATER 0)
+    message(STATUS "Baseline peak RSS: ${_baseline_peak_rss_kb} kB")
+    math(EXPR _memory_lhs "${_peak_rss_kb} * 100")
+    math(EXPR _memory_rhs "${_baseline_peak_rss_kb} * (100 + ${BENCHMARK_TOLERANCE})")
+    if(_memory_lhs GREATER _memory_rhs)
+        list(APPEND _regressions "peak RSS ${_peak_rss_kb} kB vs baseline ${_baseline_peak_rss_kb} kB")
+    endif()
+endif()
+
+if(_regressions)
+    string(REPLACE ";" "\n    " _regressions "${_regressions}")
+    message(FATAL_ERROR "RunPandoraBenchmark: regression beyond ${BENCHMARK_TOLERANCE}% tolerance:\n    ${_regressions}")
+endif()
+
+message(STATUS "No regression beyond ${BENCHMARK_TOLERANCE}% tolerance")
@@ -0,0 +1,105 @@
+# cmake script for measuring how the cost of a Pandora job scales with event size, invoke with cmake -P
+#
+# Runs SCALING_COMMAND once per entry in SCALING_POINTS, replacing @N_HITS@ in the command line with the number of hits per event, e.g.
+# to drive the synthetic-event PandoraMicroBenchmark job from benchmark/MicroBenchmark. Writes wall time, throughput, marginal cost per hit and peak resident memory at
+# each point to the SCALING_OUTPUT csv file. The marginal cost per hit is the change in wall time per event divided by the change in hit
+# count since the previous point, so the fixed job start-up (plugins, settings, geometry) cancels out. It is also given relative to the
+# first interval: a value growing well above 100 along the curve indicates worse than linear scaling with hit count. The fixed per-job
+# cost, extrapolated to zero hits from the first two points, is reported separately.
+#
+# Input variables:
+#   SCALING_COMMAND           command line of the job, containing the @N_HITS@ placeholder
+#   SCALING_POINTS            comma-separated list of at least two hit counts per event, in strictly increasing order
+#   SCALING_N_EVENTS          number of events processed by the job at each point
+#   SCALING_OUTPUT            path of the csv file to which the scaling curve is written
+#   SCALING_WORKING_DIRECTORY working directory for the job (optional)
+#   SCALING_TIME_EXECUTABLE   GNU time executable, used to measure peak resident memory (optional)
+#-------------------------------------------------------------------------------------------------------------------------------------------
+cmake_minimum_required(VERSION 3.23 FATAL_ERROR)
+
+if(NOT SCALING_COMMAND OR NOT SCALING_COMMAND MATCHES "@N_HITS@")
+    message(FATAL_ERROR "RunPandoraScalingBenchmark: SCALING_COMMAND must be set and contain @N_HITS@, set PANDORA_BENCHMARK_SCALING_COMMAND when configuring PandoraPFA.")
+endif()
+
+if(NOT SCALING_N_EVENTS MATCHES "^[0-9]+$" OR NOT SCALING_N_EVENTS GREATER 0)
+    message(FATAL_ERROR "RunPandoraScalingBenchmark: SCALING_N_EVENTS must be a positive integer.")
+endif()
+
+string(REPLACE "," ";" _points "${SCALING_POINTS}")
+list(LENGTH _points _n_points)
+if(_n_points LESS 2)
+    message(FATAL_ERROR "RunPandoraScalingBenchmark: SCALING_POINTS must list at least two hit counts, not '${SCALING_POINTS}'.")
+endif()
+
+set(_previous_n_hits 0)
+foreach(_n_hits ${_points})
+    if(NOT _n_hits MATCHES "^[0-9]+$" OR NOT _n_hits GREATER 0)
+        message(FATAL_ERROR "RunPandoraScalingBenchmark: invalid hit count '${_n_hits}' in SCALING_POINTS.")
+    endif()
+
+    if(NOT _n_hits GREATER _previous_n_hits)
+        message(FATAL_ERROR "RunPandoraScalingBenchmark: SCALING_POINTS must be in strictly increasing order, not '${SCALING_POINTS}'.")
+    endif()
+
+    set(_previous_n_hits ${_n_hits})
+endforeach()
+
+if(NOT SCALING_OUTPUT)
+    set(SCALING_OUTPUT ${CMAKE_CURRENT_BINARY_DIR}/PandoraScalingBenchmark.csv)
+endif()
+
+if(NOT SCALING_WORKING_DIRECTORY)
+    set(SCALING_WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+endif()
+
+include(${CMAKE_CURRENT_LIST_DIR}/PandoraBenchmarkMacros.cmake)
+
+#-------------------------------------------------------------------------------------------------------------------------------------------
+# Run the job at each point and write the curve
+set(_csv_text "n_hits,wall_ms,events_per_second,marginal_ns_per_hit,relative_marginal_cost,peak_rss_kb\n")
+set(_previous_n_hits "")
+set(_previous_wall_ms "")
+set(_reference_ns_per_hit "")
+
+foreach(_n_hits ${_points})
+    string(REPLACE "@N_HITS@" "${_n_hits}" _command_line "${SCALING_COMMAND}")
+    PANDORA_RUN_TIMED_JOB("${_command_line}" ${SCALING_WORKING_DIRECTORY} "${SCALING_TIME_EXECUTABLE}" _wall_ms _peak_rss_kb)
+
+    math(EXPR _events_per_second_x100 "(${SCALING_N_EVENTS} * 100000) / ${_wall_ms}")
+    PANDORA_FORMAT_HUNDREDTHS(${_events_per_second_x100} _events_per_second)
+    set(_ns_per_hit "")
+    set(_relative_cost "")
+
+    if(NOT _previous_n_hits STREQUAL "")
+        math(EXPR _ns_per_hit "((${_wall_ms} - ${_previous_wall_ms}) * 1000000) / (${SCALING_N_EVENTS} * (${_n_hits} - ${_previous_n_hits}))")
+
+        if(_reference_ns_per_hit STREQUAL "")
+            set(_reference_ns_per_hit ${_ns_per_hit})
+            math(EXPR _fixed_ms "${_previous_wall_ms} - (${_ns_per_hit} * ${SCALING_N_EVENTS} * ${_previous_n_hits}) / 1000000")
+            if(NOT _reference_ns_per_hit GREATER 0)
+                message(WARNING "RunPandoraScalingBenchmark: no measurable cost increase between the first two points, relative costs are not reported. "
+                    "Use more events or more widely spaced SCALING_POINTS.")
+            endif()
+        endif()
+
+        if(_reference_ns_per_hit GREATER 0 AND _ns_per_hit GREATER -1)
+            math(EXPR _relative_cost_x100 "(${_ns_per_hit} * 10000) / ${_reference_ns_per_hit}")
+            PANDORA_FORMAT_HUNDREDTHS(${_relative_cost_x100} _relative_cost)
+        endif()
+    endif()
+
+    if(_ns_per_hit STREQUAL "")
+        message(STATUS "Hits per event: ${_n_hits}, wall time: ${_wall_ms} ms, throughput: ${_events_per_second} events/s")
+    else()
+        message(STATUS "Hits per event: ${_n_hits}, wall time: ${_wall_ms} ms, throughput: ${_events_per_second} events/s, "
+            "marginal cost: ${_ns_per_hit} ns/hit, relative marginal cost: ${_relative_cost}")
+    endif()
+    string(APPEND _csv_text "${_n_hits},${_wall_ms},${_events_per_second},${_ns_per_hit},${_relative_cost},${_peak_rss_kb}\n")
+
+    set(_previous_n_hits ${_n_hits})
+    set(_previous_wall_ms ${_wall_ms})
+endforeach()
+
+message(STATUS "Estimated fixed job cost (extrapolated to zero hits): ${_fixed_ms} ms")
+file(WRITE ${SCALING_OUTPUT} ${_csv_text})
+message(STATUS "Scaling curve written to ${SCALING_OUTPUT}")